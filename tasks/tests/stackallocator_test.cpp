@@ -511,10 +511,12 @@ void TestPerformance() {
         first = 0, second = 0;
     }
 
+    constexpr int kRuns = 3;
+
     double mean_first = 0.0;
     double mean_second = 0.0;
  
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < kRuns; ++i) {
         first = ListPerformanceTest(Container<int, std::allocator<int>>());
         mean_first += first;
         oss_first << first << " ";
@@ -527,8 +529,8 @@ void TestPerformance() {
         oss_second << second << " ";
     }
 
-    mean_first /= 5;
-    mean_second /= 5;
+    mean_first /= kRuns;
+    mean_second /= kRuns;
 
     std::cerr << " Results with std::allocator: " << oss_first.str() 
             << " ms, results with StackAllocator: " << oss_second.str() << " ms " << std::endl;